@@ -0,0 +1,62 @@
+// --- Includes --- //
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <spdlog/sinks/null_sink.h>
+#include "../include/DrumDetectorConfig.hpp"
+
+// --- Code --- //
+/**
+ * Measures the per-call cost of the logging pattern inside DrumDetector::checkShape(), which runs once
+ * per quad combination. The runtime level is 'info', as on the robot, so only the call overhead is timed.
+ * Build with DRUMDETECTOR_BUILD_BENCHMARKS=ON; the *Trace target keeps trace compiled in for comparison.
+ */
+namespace
+{
+    constexpr int Iterations = 20'000'000;
+
+    template <typename Fn>
+    double measure(Fn&& fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < Iterations; i++)
+        {
+            fn();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / Iterations;
+    }
+}
+
+int main()
+{
+    auto& config = DrumDetector::Types::DrumDetectorConfig::getInstance();
+    config.setLogger(std::make_shared<spdlog::logger>("bench", std::make_shared<spdlog::sinks::null_sink_mt>()));
+    config.getLogger()->set_level(spdlog::level::info);
+
+    volatile double ratio = 7.5;
+
+    // Before: logger shared_ptr copied from the config on every call.
+    const double legacy = measure([&] {
+        config.getLogger()->trace("[DrumDetector] Shape rejected: Aspect ratio {:.2f} out of bounds.",
+                                  static_cast<double>(ratio));
+    });
+
+    // Logger handle cached once per scan, call still compiled in.
+    const auto logger = config.getLogger();
+    const double cached = measure([&] {
+        logger->trace("[DrumDetector] Shape rejected: Aspect ratio {:.2f} out of bounds.", static_cast<double>(ratio));
+    });
+
+    // After: cached handle through the level-stripping macro.
+    const double macro = measure([&] {
+        SPDLOG_LOGGER_TRACE(logger, "[DrumDetector] Shape rejected: Aspect ratio {:.2f} out of bounds.",
+                            static_cast<double>(ratio));
+    });
+
+    std::printf("SPDLOG_ACTIVE_LEVEL = %d, %d iterations\n", SPDLOG_ACTIVE_LEVEL, Iterations);
+    std::printf("config.getLogger()->trace : %6.2f ns/call\n", legacy);
+    std::printf("cached logger->trace      : %6.2f ns/call\n", cached);
+    std::printf("SPDLOG_LOGGER_TRACE       : %6.2f ns/call\n", macro);
+    return 0;
+}
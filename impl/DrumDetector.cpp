@@ -6,11 +6,21 @@
 #include <chrono>
 #include <iomanip>
 #include <sstream>
+#include <utility>
 #include "../include/DrumDetector.hpp"
 #include "../include/DrumDetectorConfig.hpp"
 
 namespace DrumDetector
 {
+    namespace
+    {
+        /**
+         * @brief Thumbnail size used by the scene-change gate (4 cells per drum slot horizontally).
+         * Each pixel is the Lab value of one block's mean BGR colour; coarse enough to average out noise.
+         */
+        const cv::Size SceneThumbSize(32, 8);
+    }
+
     DrumDetector& DrumDetector::getInstance()
     {
         static DrumDetector instance;
@@ -32,45 +42,52 @@ namespace DrumDetector
 
     void DrumDetector::init()
     {
+        this->logger = this->config.getLogger();
+
         if (this->m_cap.isOpened())
         {
-            this->config.getLogger()->info("[DrumDetector] Closing existing camera connection.");
+            SPDLOG_LOGGER_INFO(this->logger, "[DrumDetector] Closing existing camera connection.");
             this->m_cap.release();
         }
 
-        this->config.getLogger()->info("[DrumDetector] Opening camera at path '{}'...", this->config.getCameraPath());
+        // Exposure and brightness may have changed, so the cached result is no longer trustworthy.
+        this->m_lastThumb.release();
+        this->m_lastResult.items.clear();
+        this->m_lastKey = {};
+
+        SPDLOG_LOGGER_INFO(this->logger, "[DrumDetector] Opening camera at path '{}'...", this->config.getCameraPath());
         this->m_cap.open(this->config.getCameraPath(), cv::CAP_V4L2);
 
         if (!this->m_cap.isOpened())
         {
             const std::string err = "[DrumDetector] Failed to open camera at path: " + this->config.getCameraPath();
-            this->config.getLogger()->error(err);
+            SPDLOG_LOGGER_ERROR(this->logger, err);
             throw std::runtime_error(err);
         }
 
-        this->config.getLogger()->info("[DrumDetector] Camera opened successfully.");
+        SPDLOG_LOGGER_INFO(this->logger, "[DrumDetector] Camera opened successfully.");
 
         this->m_cap.set(cv::CAP_PROP_FOURCC, cv::VideoWriter::fourcc('M', 'J', 'P', 'G'));
-        this->config.getLogger()->debug("[DrumDetector] Set PROP_FOURCC value: MJPG");
+        SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Set PROP_FOURCC value: MJPG");
 
         this->m_cap.set(cv::CAP_PROP_FRAME_WIDTH, 1920);
-        this->config.getLogger()->debug("[DrumDetector] Set PROP_FRAME_WIDTH value: 1920");
+        SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Set PROP_FRAME_WIDTH value: 1920");
 
         this->m_cap.set(cv::CAP_PROP_FRAME_HEIGHT, 1080);
-        this->config.getLogger()->debug("[DrumDetector] Set PROP_FRAME_HEIGHT value: 1080");
+        SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Set PROP_FRAME_HEIGHT value: 1080");
 
         this->m_cap.set(cv::CAP_PROP_BRIGHTNESS, this->config.getBrightness());
-        this->config.getLogger()->debug("[DrumDetector] Set PROP_BRIGHTNESS value: {}", this->config.getBrightness());
+        SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Set PROP_BRIGHTNESS value: {}", this->config.getBrightness());
 
         this->m_cap.set(cv::CAP_PROP_AUTO_EXPOSURE, 1);
-        this->config.getLogger()->debug("[DrumDetector] Set PROP AUTO_EXPOSURE value: 1");
+        SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Set PROP AUTO_EXPOSURE value: 1");
 
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
         this->m_cap.set(cv::CAP_PROP_EXPOSURE, this->config.getExposure());
-        this->config.getLogger()->debug("[DrumDetector] Set PROP_EXPOSURE value: {}", this->config.getExposure());
+        SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Set PROP_EXPOSURE value: {}", this->config.getExposure());
 
-        this->config.getLogger()->debug("[DrumDetector] Camera initialized with {}x{}, exposure {} and brightness {}",
-                                            1920, 1080, this->config.getExposure(), this->config.getBrightness());
+        SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Camera initialized with {}x{}, exposure {} and brightness {}",
+                            1920, 1080, this->config.getExposure(), this->config.getBrightness());
 
         std::this_thread::sleep_for(std::chrono::seconds(2));
     }
@@ -86,7 +103,7 @@ namespace DrumDetector
 
         if (temp.empty())
         {
-            this->config.getLogger()->error("[DrumDetector] Failed to capture frame from camera!");
+            SPDLOG_LOGGER_ERROR(this->logger, "[DrumDetector] Failed to capture frame from camera!");
             return temp;
         }
 
@@ -94,7 +111,7 @@ namespace DrumDetector
         const int newHeight = static_cast<int>(temp.rows * ratio);
         const int yStart = temp.rows - newHeight;
 
-        this->config.getLogger()->debug("[DrumDetector] ROI applied: Keep bottom {}%", static_cast<int>(ratio * 100));
+        SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] ROI applied: Keep bottom {}%", static_cast<int>(ratio * 100));
 
         const cv::Rect roi(0, yStart, temp.cols, newHeight);
         return temp(roi).clone();
@@ -121,17 +138,64 @@ namespace DrumDetector
         return lab;
     }
 
-    Types::DrumColorList DrumDetector::getDrumColors()
+    cv::Mat DrumDetector::makeThumbnail(const cv::Mat& frame)
     {
+        cv::Mat thumb;
+        cv::resize(frame, thumb, SceneThumbSize, 0, 0, cv::INTER_AREA);
+        cv::cvtColor(thumb, thumb, cv::COLOR_BGR2Lab);
+        return thumb;
+    }
+
+    DrumDetector::SceneCacheKey DrumDetector::makeSceneCacheKey() const
+    {
+        return {this->config.getName(), this->config.getBThreshYellow(), this->config.getBlueMax(),
+                this->config.getPinkMin(), this->config.getSaturationBoost(), this->config.getKeepPercentage(),
+                this->config.getTrayWidth(), this->config.getTrayHeight(), this->config.getMinMarkerArea(),
+                this->config.getMaxMarkerArea()};
+    }
+
+    bool DrumDetector::isSceneUnchanged(const cv::Mat& thumb, const SceneCacheKey& key) const
+    {
+        const double threshold = this->config.getSceneChangeThreshold();
+        if (threshold <= 0.0 || this->m_lastThumb.empty() || this->m_lastResult.items.empty())
+            return false;
+
+        if (key != this->m_lastKey)
+        {
+            SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Profile changed since cached result - gate skipped.");
+            return false;
+        }
+
+        // Worst block over all Lab channels, so a single swapped slot or a Blue/Pink swap
+        // with equal luminance is not averaged away.
+        const double maxDiff = cv::norm(thumb, this->m_lastThumb, cv::NORM_INF);
+        SPDLOG_LOGGER_TRACE(this->logger, "[DrumDetector] Scene delta {:.2f} (threshold {:.2f}).", maxDiff, threshold);
+        return maxDiff <= threshold;
+    }
+
+    Types::DrumColorList DrumDetector::getDrumColors(bool forceScan)
+    {
+        this->logger = this->config.getLogger();
+
         Types::DrumColorList result;
         cv::Mat frame = getSnapshot();
 
         if (frame.empty())
         {
-            this->config.getLogger()->warn("[DrumDetector] Snapshot failed - frame is empty.");
+            SPDLOG_LOGGER_WARN(this->logger, "[DrumDetector] Snapshot failed - frame is empty.");
             return result;
         }
 
+        cv::Mat thumb = makeThumbnail(frame);
+        SceneCacheKey key = makeSceneCacheKey();
+        if (!forceScan && isSceneUnchanged(thumb, key))
+        {
+            this->m_sceneGateHits++;
+            SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Scene unchanged - returning cached result (gate hits: {}).",
+                                this->m_sceneGateHits);
+            return this->m_lastResult;
+        }
+
         std::filesystem::path configPath(this->config.getConfigPath());
         std::filesystem::path debugDir = configPath.parent_path() / "DrumDetectorDebug";
 
@@ -144,7 +208,7 @@ namespace DrumDetector
         std::string timestamp = ss.str();
 
         cv::imwrite((debugDir / (timestamp + "_1_raw.png")).string(), frame);
-        this->config.getLogger()->debug("[DrumDetector] Snapshot captured. Saving debug images to {}", debugDir.string());
+        SPDLOG_LOGGER_DEBUG(this->logger, "[DrumDetector] Snapshot captured. Saving debug images to {}", debugDir.string());
 
         cv::Mat processed, mask;
         cv::GaussianBlur(frame, processed, cv::Size(5, 5), 0);
@@ -165,11 +229,11 @@ namespace DrumDetector
                     candidates.emplace_back(m.m10 / m.m00, m.m01 / m.m00);
             }
         }
-        this->config.getLogger()->trace("[DrumDetector] Found {} raw contours.", contours.size());
+        SPDLOG_LOGGER_TRACE(this->logger, "[DrumDetector] Found {} raw contours.", contours.size());
 
         if (candidates.size() < 4)
         {
-            this->config.getLogger()->warn("[DrumDetector] Not enough marker candidates! Found {}, need 4.", candidates.size());
+            SPDLOG_LOGGER_WARN(this->logger, "[DrumDetector] Not enough marker candidates! Found {}, need 4.", candidates.size());
             return result;
         }
 
@@ -195,12 +259,12 @@ namespace DrumDetector
 
         if (best_pts.empty())
         {
-            this->config.getLogger()->warn("[DrumDetector] Geometry check failed: No valid tray-shaped quadrilateral found "
-                               "among {} candidates.", candidates.size());
+            SPDLOG_LOGGER_WARN(this->logger, "[DrumDetector] Geometry check failed: No valid tray-shaped quadrilateral found "
+                                             "among {} candidates.", candidates.size());
             return result;
         }
 
-        this->config.getLogger()->info("[DrumDetector] Tray detected! Processing color slots...");
+        SPDLOG_LOGGER_INFO(this->logger, "[DrumDetector] Tray detected! Processing color slots...");
 
         cv::Mat warped;
         cv::Point2f dst_pts[4] = {
@@ -237,6 +301,10 @@ namespace DrumDetector
                 result.items.push_back(Types::DrumColor::Empty);
         }
 
+        this->m_lastThumb = thumb;
+        this->m_lastResult = result;
+        this->m_lastKey = std::move(key);
+
         return result;
     }
 
@@ -270,7 +338,7 @@ namespace DrumDetector
 
         if (const double ratio = width / height; ratio < 2.5 || ratio > 6.0)
         {
-            this->config.getLogger()->trace("[DrumDetector] Shape rejected: Aspect ratio {:.2f} out of bounds.", ratio);
+            SPDLOG_LOGGER_TRACE(this->logger, "[DrumDetector] Shape rejected: Aspect ratio {:.2f} out of bounds.", ratio);
             return false;
         }
 
@@ -4,6 +4,7 @@
 #include <nlohmann/json.hpp>
 #include <utility>
 #include <stdexcept>
+#include <spdlog/async.h>
 #include "../include/DrumDetectorConfig.hpp"
 
 // --- Code --- //
@@ -57,6 +58,7 @@ namespace DrumDetector::Types
             m_minMarkerArea = internal.value("MinMarkerArea", m_minMarkerArea);
             m_maxMarkerArea = internal.value("MaxMarkerArea", m_maxMarkerArea);
             m_keepPercentage = internal.value("KeepPercentage", m_keepPercentage);
+            m_sceneChangeThreshold = internal.value("SceneChangeThreshold", m_sceneChangeThreshold);
             if (!drumSection.contains("CurrentProfile") || !drumSection.contains("ProfileList"))
             {
                 throw std::runtime_error("[DrumDetectorConfig] 'CurrentProfile' or 'ProfileList' missing");
@@ -96,8 +98,24 @@ namespace DrumDetector::Types
         }
     }
 
-    void DrumDetectorConfig::setLogger(std::shared_ptr<spdlog::logger> logger)
+    void DrumDetectorConfig::setLogger(std::shared_ptr<spdlog::logger> logger, bool async)
     {
+        if (async && !std::dynamic_pointer_cast<spdlog::async_logger>(logger))
+        {
+            // Private pool, so spdlog's global pool (and the application's use of it) stays untouched.
+            if (!this->m_threadPool)
+            {
+                this->m_threadPool = std::make_shared<spdlog::details::thread_pool>(8192, 1);
+            }
+
+            // Drop the oldest queued message instead of blocking the caller when the queue is full.
+            auto asyncLogger = std::make_shared<spdlog::async_logger>(logger->name(), logger->sinks().begin(),
+                logger->sinks().end(), this->m_threadPool, spdlog::async_overflow_policy::overrun_oldest);
+            asyncLogger->set_level(logger->level());
+            asyncLogger->flush_on(logger->flush_level());
+            logger = std::move(asyncLogger);
+        }
+
         this->m_logger = std::move(logger);
         this->m_logger->info("[DrumDetectorConfig] logger set successfully!");
     }
@@ -3,6 +3,7 @@
 
 // --- Includes --- //
 #include <opencv2/opencv.hpp>
+#include <tuple>
 #include <vector>
 #include "DrumColorList.hpp"
 #include "DrumDetectorConfig.hpp"
@@ -33,9 +34,14 @@ namespace DrumDetector
 
             /** * @brief Executes the detection pipeline.
              * Captures a frame, finds the tray, warps it and classifies the 8 drum slots.
+             * If the frame did not change since the last accepted result, the cached list is returned.
+             * @param forceScan Skips the scene-change gate and always runs the full pipeline.
              * @return Types::DrumColorList The list of 8 detected colors.
              */
-            Types::DrumColorList getDrumColors();
+            Types::DrumColorList getDrumColors(bool forceScan = false);
+
+            /** @brief Returns how many scans were answered from the cache by the scene-change gate. */
+            [[nodiscard]] std::size_t getSceneGateHits() const { return m_sceneGateHits; }
 
         private:
             /** @brief Private constructor for Singleton. */
@@ -46,13 +52,31 @@ namespace DrumDetector
 
             cv::VideoCapture m_cap;
             Types::DrumDetectorConfig& config;
-            std::shared_ptr<spdlog::logger> logger;
+            std::shared_ptr<spdlog::logger> logger; ///< Cached from the config once per init() / scan.
+
+            // --- Scene-Change Gate ---
+            /** @brief Config inputs the cached result depends on (profile, thresholds, tray and marker geometry). */
+            using SceneCacheKey = std::tuple<std::string, int, int, int, double, double, int, int, double, double>;
+
+            cv::Mat m_lastThumb;
+            Types::DrumColorList m_lastResult;
+            SceneCacheKey m_lastKey;
+            std::size_t m_sceneGateHits{};
 
             // --- Internal Processing Steps ---
 
             /** @brief Flushes the camera buffer and retrieves the latest frame. */
             [[nodiscard]] cv::Mat getSnapshot();
 
+            /** @brief Downsamples the ROI to a small Lab thumbnail for change detection. */
+            [[nodiscard]] static cv::Mat makeThumbnail(const cv::Mat& frame);
+
+            /** @brief Collects the current config values the classification result depends on. */
+            [[nodiscard]] SceneCacheKey makeSceneCacheKey() const;
+
+            /** @brief Checks whether no block of the thumbnail changed since the cached result was produced. */
+            [[nodiscard]] bool isSceneUnchanged(const cv::Mat& thumb, const SceneCacheKey& key) const;
+
             /** @brief Sorts 4 points in clockwise order for perspective transform. */
             [[nodiscard]] static std::vector<cv::Point2f> sortRadial(std::vector<cv::Point2f> pts);
 
@@ -6,6 +6,12 @@
 #include <memory>
 #include <spdlog/spdlog.h>
 
+// --- Forward Declarations --- //
+namespace spdlog::details
+{
+    class thread_pool;
+}
+
 // --- Code --- //
 /**
 * @namespace DrumDetector
@@ -30,7 +36,8 @@ namespace DrumDetector::Types
      * "TrayWidth": 1000,
      * "TrayHeight": 250,
      * "MinMarkerArea": 200,
-     * "MaxMarkerArea": 10000
+     * "MaxMarkerArea": 10000,
+     * "SceneChangeThreshold": 0.0
      * },
      * "CurrentProfile": "ProfileA",
      * "ProfileList": [
@@ -76,8 +83,12 @@ namespace DrumDetector::Types
             /**
              * @brief Sets a spdlogger for debug purposes.
              * @param logger Logger object used in the main program.
+             * @param async If true, the logger's sinks are wrapped in an spdlog async logger so that
+             *              console/disk I/O runs on a private thread pool and never blocks detection.
+             *              The sinks are shared with the given logger and written from the pool thread,
+             *              so the caller must pass thread-safe (_mt) sinks; this is not checked.
              */
-            void setLogger(std::shared_ptr<spdlog::logger> logger);
+            void setLogger(std::shared_ptr<spdlog::logger> logger, bool async = false);
 
             // --- Profile Getters ---
             [[nodiscard]] std::string getName() const { return m_name; }
@@ -96,6 +107,7 @@ namespace DrumDetector::Types
             [[nodiscard]] double getMinMarkerArea() const { return m_minMarkerArea; }
             [[nodiscard]] double getMaxMarkerArea() const { return m_maxMarkerArea; }
             [[nodiscard]] double getKeepPercentage() const { return m_keepPercentage; }
+            [[nodiscard]] double getSceneChangeThreshold() const { return m_sceneChangeThreshold; }
 
             // --- Others --- //
             [[nodiscard]] std::string getConfigPath() const { return config_path; }
@@ -114,12 +126,14 @@ namespace DrumDetector::Types
 
             // --- Internal hardware params --- //
             std::shared_ptr<spdlog::logger> m_logger;
+            std::shared_ptr<spdlog::details::thread_pool> m_threadPool; ///< Backs the async logger, see setLogger().
             std::string m_cameraPath{};
             int m_trayWidth{};
             int m_trayHeight{};
             double m_minMarkerArea{};
             double m_maxMarkerArea{};
             double m_keepPercentage{};
+            double m_sceneChangeThreshold{}; ///< Max. per-block Lab delta treated as unchanged, <= 0 disables the gate.
 
             // --- Others --- //
             std::string config_path{};